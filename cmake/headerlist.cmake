@@ -3,4 +3,5 @@ set(headers ${headers}
 	src/LookupFilters.h
 	src/Manager.h
 	src/PCH.h
+	src/WorldState.h
 )
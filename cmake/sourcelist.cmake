@@ -3,5 +3,6 @@ set(sources ${sources}
 	src/LookupFilters.cpp
 	src/Manager.cpp
 	src/PCH.cpp
+	src/WorldState.cpp
 	src/main.cpp
 )
@@ -74,6 +74,62 @@ namespace AnimObjectSwap::Filter
 		}
 	}
 
+	bool match_string_filter(RE::Actor* a_actor, const std::string& a_string)
+	{
+		if (string::icontains(a_string, ".nif") || a_string.contains('\\')) {
+			const auto inventory = a_actor->GetInventory();
+			return std::ranges::any_of(inventory, [&](const auto& inv) {
+				const auto model = inv.first->As<RE::TESModel>();
+				return model && string::icontains(model->model, a_string);
+			});
+		} else {
+			if (a_actor->HasKeywordString(a_string)) {
+				return true;
+			}
+			if (auto cell = a_actor->GetParentCell(); cell && Manager::GetEditorID(cell) == a_string) {
+				return true;
+			}
+			const auto inventory = a_actor->GetInventory();
+			return std::ranges::any_of(inventory, [&](const auto& inv) {
+				const auto keywordForm = inv.first->As<RE::BGSKeywordForm>();
+				return keywordForm && keywordForm->HasKeywordString(a_string);
+			});
+		}
+	}
+
+	bool contains_string_filter(RE::Actor* a_actor, const std::string& a_string)
+	{
+		if (string::icontains(a_string, ".nif") || a_string.contains('\\')) {
+			const auto inventory = a_actor->GetInventory();
+			return std::ranges::any_of(inventory, [&](const auto& inv) {
+				const auto model = inv.first->As<RE::TESModel>();
+				return model && string::icontains(model->model, a_string);
+			});
+		} else {
+			if (const auto actorbase = a_actor->GetActorBase(); actorbase) {
+				if (actorbase->ContainsKeyword(a_string)) {
+					return true;
+				}
+				if (const auto edid = Manager::GetEditorID(actorbase); string::icontains(edid, a_string)) {
+					return true;
+				}
+			}
+			if (auto cell = a_actor->GetParentCell(); cell && string::icontains(Manager::GetEditorID(cell), a_string)) {
+				return true;
+			}
+			const auto inventory = a_actor->GetInventory();
+			return std::ranges::any_of(inventory, [&](const auto& inv) {
+				const auto keywordForm = inv.first->As<RE::BGSKeywordForm>();
+				if (keywordForm && keywordForm->ContainsKeywordString(a_string)) {
+					return true;
+				} else {
+					const auto edid = Manager::GetEditorID(inv.first);
+					return string::icontains(edid, a_string);
+				}
+			});
+		}
+	}
+
 	bool matches_filter(RE::Actor* a_actor, const FormIDStrVec& a_formIDStrVec, bool a_matchAll = false)
 	{
 		const auto match_filter = [&](const FormIDStr& a_formIDStr) {
@@ -81,29 +137,9 @@ namespace AnimObjectSwap::Filter
 				if (auto form = RE::TESForm::LookupByID(std::get<RE::FormID>(a_formIDStr)); form) {
 					return match_form_filter(a_actor, form);
 				}
-			} else {
-				const auto& string = std::get<std::string>(a_formIDStr);
-				if (string::icontains(string, ".nif") || string.contains('\\')) {
-					const auto inventory = a_actor->GetInventory();
-					return std::ranges::any_of(inventory, [&](const auto& inv) {
-						const auto model = inv.first->As<RE::TESModel>();
-						return model && string::icontains(model->model, string);
-					});
-				} else {
-					if (a_actor->HasKeywordString(string)) {
-						return true;
-					}
-					if (auto cell = a_actor->GetParentCell(); cell && Manager::GetEditorID(cell) == string) {
-						return true;
-					}
-					const auto inventory = a_actor->GetInventory();
-					return std::ranges::any_of(inventory, [&](const auto& inv) {
-						const auto keywordForm = inv.first->As<RE::BGSKeywordForm>();
-						return keywordForm && keywordForm->HasKeywordString(string);
-					});
-				}
+				return false;
 			}
-			return false;
+			return match_string_filter(a_actor, std::get<std::string>(a_formIDStr));
 		};
 
 		if (a_matchAll) {
@@ -116,40 +152,144 @@ namespace AnimObjectSwap::Filter
 	bool contains_filter(RE::Actor* a_actor, const FormIDStrVec& a_formIDStrVec)
 	{
 		return std::ranges::any_of(a_formIDStrVec, [&](const FormIDStr& a_formIDStr) {
-			if (std::holds_alternative<std::string>(a_formIDStr)) {
-				const auto& string = std::get<std::string>(a_formIDStr);
-				if (string::icontains(string, ".nif") || string.contains('\\')) {
-					const auto inventory = a_actor->GetInventory();
-					return std::ranges::any_of(inventory, [&](const auto& inv) {
-						const auto model = inv.first->As<RE::TESModel>();
-						return model && string::icontains(model->model, string);
-					});
-				} else {
-					if (const auto actorbase = a_actor->GetActorBase(); actorbase) {
-						if (actorbase->ContainsKeyword(string)) {
-							return true;
-						}
-						if (const auto edid = Manager::GetEditorID(actorbase); string::icontains(edid, string)) {
-							return true;
-						}
-					}
-					if (auto cell = a_actor->GetParentCell(); cell && string::icontains(Manager::GetEditorID(cell), string)) {
-						return true;
-					}
-					const auto inventory = a_actor->GetInventory();
-					return std::ranges::any_of(inventory, [&](const auto& inv) {
-						const auto keywordForm = inv.first->As<RE::BGSKeywordForm>();
-						if (keywordForm && keywordForm->ContainsKeywordString(string)) {
-							return true;
-						} else {
-							const auto edid = Manager::GetEditorID(inv.first);
-							return string::icontains(edid, string);
-						}
-					});
-				}
+			return std::holds_alternative<std::string>(a_formIDStr) && contains_string_filter(a_actor, std::get<std::string>(a_formIDStr));
+		});
+	}
+
+	CompiledFilter compile_filter(const FormIDStrVec& a_formIDStrVec)
+	{
+		CompiledFilter compiledFilter{};
+
+		for (const auto& formIDStr : a_formIDStrVec) {
+			if (std::holds_alternative<std::string>(formIDStr)) {
+				compiledFilter.strings.push_back(std::get<std::string>(formIDStr));
+				continue;
+			}
+
+			const auto formID = std::get<RE::FormID>(formIDStr);
+			const auto form = RE::TESForm::LookupByID(formID);
+			if (!form) {
+				compiledFilter.unresolved = true;
+				continue;
+			}
+
+			switch (form->GetFormType()) {
+			case RE::FormType::NPC:
+				compiledFilter.npcs.insert(formID);
+				break;
+			case RE::FormType::Race:
+				compiledFilter.races.insert(formID);
+				break;
+			default:
+				compiledFilter.forms.push_back(form);
+				break;
+			}
+		}
+
+		return compiledFilter;
+	}
+
+	bool matches_compiled_filter(RE::Actor* a_actor, const CompiledFilter& a_filter, bool a_matchAll = false)
+	{
+		const auto actorbase = a_actor->GetActorBase();
+		const auto race = a_actor->GetRace();
+
+		const auto baseID = actorbase ? actorbase->GetFormID() : 0;
+		const auto raceID = race ? race->GetFormID() : 0;
+
+		const auto match_form = [&](RE::TESForm* a_form) { return match_form_filter(a_actor, a_form); };
+		const auto match_string = [&](const std::string& a_string) { return match_string_filter(a_actor, a_string); };
+
+		if (a_matchAll) {
+			if (a_filter.unresolved) {
+				return false;
+			}
+			if (!std::ranges::all_of(a_filter.npcs, [&](const auto formID) { return formID == baseID; })) {
+				return false;
+			}
+			if (!std::ranges::all_of(a_filter.races, [&](const auto formID) { return formID == raceID; })) {
+				return false;
+			}
+			return std::ranges::all_of(a_filter.forms, match_form) && std::ranges::all_of(a_filter.strings, match_string);
+		}
+
+		if (a_filter.npcs.contains(baseID) || a_filter.races.contains(raceID)) {
+			return true;
+		}
+		return std::ranges::any_of(a_filter.forms, match_form) || std::ranges::any_of(a_filter.strings, match_string);
+	}
+
+	bool pass_traits(RE::Actor* a_actor, const Traits& a_traits)
+	{
+		if (a_traits.sex != RE::SEX::kNone) {
+			const auto actorbase = a_actor->GetActorBase();
+			if (actorbase && actorbase->GetSex() != a_traits.sex) {
+				return false;
 			}
+		}
+
+		if (a_traits.child && a_actor->IsChild() != *a_traits.child) {
 			return false;
-		});
+		}
+
+		return true;
+	}
+
+	std::uint8_t compile_traits(const Traits& a_traits)
+	{
+		std::uint8_t traits = CompiledConditions::kNone;
+
+		if (a_traits.sex == RE::SEX::kMale) {
+			traits |= CompiledConditions::kMale;
+		} else if (a_traits.sex == RE::SEX::kFemale) {
+			traits |= CompiledConditions::kFemale;
+		}
+
+		if (a_traits.child) {
+			traits |= *a_traits.child ? CompiledConditions::kChild : CompiledConditions::kAdult;
+		}
+
+		return traits;
+	}
+
+	bool pass_compiled_traits(RE::Actor* a_actor, std::uint8_t a_traits)
+	{
+		std::uint8_t actorTraits = CompiledConditions::kNone;
+
+		if (a_traits & (CompiledConditions::kMale | CompiledConditions::kFemale)) {
+			// no actorbase passes either sex, same as the interpreter
+			if (const auto actorbase = a_actor->GetActorBase(); !actorbase) {
+				actorTraits |= CompiledConditions::kMale | CompiledConditions::kFemale;
+			} else if (const auto sex = actorbase->GetSex(); sex == RE::SEX::kMale) {
+				actorTraits |= CompiledConditions::kMale;
+			} else if (sex == RE::SEX::kFemale) {
+				actorTraits |= CompiledConditions::kFemale;
+			}
+		}
+
+		if (a_traits & (CompiledConditions::kChild | CompiledConditions::kAdult)) {
+			actorTraits |= a_actor->IsChild() ? CompiledConditions::kChild : CompiledConditions::kAdult;
+		}
+
+		return (actorTraits & a_traits) == a_traits;
+	}
+
+	CompiledConditions Compile(const Conditions& a_conditions)
+	{
+		CompiledConditions compiledConditions{
+			.traits = compile_traits(a_conditions.traits),
+			.ALL = compile_filter(a_conditions.ALL),
+			.NOT = compile_filter(a_conditions.NOT),
+			.MATCH = compile_filter(a_conditions.MATCH)
+		};
+
+		for (const auto& formIDStr : a_conditions.ANY) {
+			if (std::holds_alternative<std::string>(formIDStr)) {
+				compiledConditions.ANY.push_back(std::get<std::string>(formIDStr));
+			}
+		}
+
+		return compiledConditions;
 	}
 
 	bool PassFilter(RE::Actor* a_actor, const Conditions& a_conditions)
@@ -170,16 +310,72 @@ namespace AnimObjectSwap::Filter
 			return false;
 		}
 
-		const auto& traits = a_conditions.traits;
+		return pass_traits(a_actor, a_conditions.traits);
+	}
+
+	bool PassFilter(RE::Actor* a_actor, const CompiledConditions& a_conditions)
+	{
+		// cheap trait compares first, string/inventory scans last
+		if (a_conditions.traits != CompiledConditions::kNone && !pass_compiled_traits(a_actor, a_conditions.traits)) {
+			return false;
+		}
+
+		if (!a_conditions.ALL.empty() && !matches_compiled_filter(a_actor, a_conditions.ALL, true)) {
+			return false;
+		}
+
+		if (!a_conditions.NOT.empty() && matches_compiled_filter(a_actor, a_conditions.NOT)) {
+			return false;
+		}
+
+		if (!a_conditions.MATCH.empty() && !matches_compiled_filter(a_actor, a_conditions.MATCH)) {
+			return false;
+		}
+
+		if (!a_conditions.ANY.empty() && !std::ranges::any_of(a_conditions.ANY, [&](const auto& a_string) { return contains_string_filter(a_actor, a_string); })) {
+			return false;
+		}
+
+		return true;
+	}
+
+	bool PassFilter(const WorldState::Snapshot& a_worldState, const WorldConditions& a_conditions)
+	{
+		const auto in_range = [](float a_value, const Range& a_range) {
+			return a_value >= a_range.first && a_value <= a_range.second;
+		};
+
+		const auto in_tracked_range = [&](const Map<RE::FormID, float>& a_values, const std::pair<RE::FormID, Range>& a_condition) {
+			const auto it = a_values.find(a_condition.first);
+			return it != a_values.end() && in_range(it->second, a_condition.second);
+		};
 
-		if (traits.sex != RE::SEX::kNone) {
-            const auto actorbase = a_actor->GetActorBase();
-		    if (actorbase && actorbase->GetSex() != traits.sex) {
+		if (a_conditions.invalid) {
+			return false;
+		}
+
+		if (const auto& hours = a_conditions.hours; hours) {
+			// ranges such as 20-6 wrap around midnight
+			const auto& [start, end] = *hours;
+			const auto hour = a_worldState.gameHour;
+			if (start <= end ? !in_range(hour, *hours) : hour < start && hour > end) {
 				return false;
 			}
 		}
 
-		if (traits.child && a_actor->IsChild() != *traits.child) {
+		if (!a_conditions.weathers.empty() && !a_conditions.weathers.contains(a_worldState.weather)) {
+			return false;
+		}
+
+		if (!a_conditions.climates.empty() && !a_conditions.climates.contains(a_worldState.climate)) {
+			return false;
+		}
+
+		if (!std::ranges::all_of(a_conditions.globals, [&](const auto& global) { return in_tracked_range(a_worldState.globals, global); })) {
+			return false;
+		}
+
+		if (!std::ranges::all_of(a_conditions.questStages, [&](const auto& quest) { return in_tracked_range(a_worldState.questStages, quest); })) {
 			return false;
 		}
 
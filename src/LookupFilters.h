@@ -1,8 +1,13 @@
 #pragma once
 
 #include "Manager.h"
+#include "WorldState.h"
 
 namespace AnimObjectSwap::Filter
 {
+	CompiledConditions Compile(const Conditions& a_conditions);
+
 	bool PassFilter(RE::Actor* a_actor, const Conditions& a_conditions);
+	bool PassFilter(RE::Actor* a_actor, const CompiledConditions& a_conditions);
+	bool PassFilter(const WorldState::Snapshot& a_worldState, const WorldConditions& a_conditions);
 }
@@ -1,15 +1,36 @@
 #include "Manager.h"
 #include "LookupFilters.h"
 #include "MergeMapperPluginAPI.h"
+#include "WorldState.h"
 
 namespace AnimObjectSwap
 {
+	bool split_formID(const std::string& a_str, RE::FormID& a_formID, std::string& a_modName)
+	{
+		auto splitID = string::split(a_str, "~");
+		if (splitID.size() != 2) {
+			return false;
+		}
+
+		std::string_view hex = splitID[0];
+		if (hex.starts_with("0x"sv) || hex.starts_with("0X"sv)) {
+			hex.remove_prefix(2);
+		}
+		const auto [ptr, ec] = std::from_chars(hex.data(), hex.data() + hex.size(), a_formID, 16);
+		if (ec != std::errc() || ptr != hex.data() + hex.size()) {
+			return false;
+		}
+
+		a_modName = splitID[1];
+		return true;
+	}
+
 	RE::FormID Manager::GetFormID(const std::string& a_str)
 	{
 		if (a_str.contains("~"sv)) {
-			if (auto splitID = string::split(a_str, "~"); splitID.size() == 2) {
-				const auto formID = string::lexical_cast<RE::FormID>(splitID[0], true);
-				const auto& modName = splitID[1];
+			RE::FormID formID = 0;
+			std::string modName;
+			if (split_formID(a_str, formID, modName)) {
 				if (g_mergeMapperInterface) {
 					const auto [mergedModName, mergedFormID] = g_mergeMapperInterface->GetNewFormID(modName.c_str(), formID);
 					return RE::TESDataHandler::GetSingleton()->LookupFormID(mergedFormID, (const char*)mergedModName);
@@ -24,6 +45,19 @@ namespace AnimObjectSwap
 		return static_cast<RE::FormID>(0);
 	}
 
+	bool Manager::IsValidFormID(const std::string& a_str)
+	{
+		if (a_str.empty()) {
+			return false;
+		}
+		if (!a_str.contains("~"sv)) {
+			return true;
+		}
+		RE::FormID formID = 0;
+		std::string modName;
+		return split_formID(a_str, formID, modName);
+	}
+
 	std::string Manager::GetEditorID(const RE::TESForm* a_form)
 	{
 		switch (a_form->GetFormType()) {
@@ -67,6 +101,27 @@ namespace AnimObjectSwap
 		}
 	}
 
+	void Manager::LoadSettings()
+	{
+		constexpr auto path = R"(Data\SKSE\Plugins\po3_AnimObjectSwapper.ini)";
+
+		CSimpleIniA ini;
+		ini.SetUnicode();
+
+		if (const auto rc = ini.LoadFile(path); rc < 0) {
+			logger::info("	No settings file found, using defaults");
+			return;
+		}
+
+		_compileFilters = ini.GetBoolValue("Settings", "bCompileFilters", _compileFilters);
+		_warmUpCount = static_cast<std::uint32_t>(ini.GetLongValue("Settings", "iWarmUpCount", _warmUpCount));
+		_selfCheck = ini.GetBoolValue("Settings", "bSelfCheck", _selfCheck);
+
+		logger::info("	Compile filters : {}", _compileFilters);
+		logger::info("	Self check : {}", _selfCheck);
+		logger::info("	Warm up count : {}", _warmUpCount);
+	}
+
 	bool Manager::LoadForms()
 	{
 		std::vector<std::string> configs;
@@ -109,94 +164,33 @@ namespace AnimObjectSwap
 			sections.sort(CSimpleIniA::Entry::LoadOrder());
 
 			for (auto& [section, comment, keyOrder] : sections) {
-				bool noConditions = true;
-				ConditionalSwap conditionalSwap{};
-
-				constexpr auto push_filter = [](const std::string& a_condition, FormIDStrVec& a_processedFilters) {
-					if (const auto processedID = GetFormID(a_condition); processedID != 0) {
-						a_processedFilters.push_back(processedID);
-					} else {
-						logger::error("		Filter  [{}] INFO - unable to find form, treating filter as string", a_condition);
-						a_processedFilters.push_back(a_condition);
-					}
-				};
-
-				constexpr auto split_sub_string = [](const std::string& a_str, const std::string& a_delimiter = ",") {
-					if (!a_str.empty() && !string::icontains(a_str, "NONE"sv)) {
-						return string::split(a_str, a_delimiter);
-					}
-					return std::vector<std::string>();
-				};
-
-				if (string::icontains(section, "|")) {
-					noConditions = false;
-
-					auto conditions = string::split(section, "|");  // [ANIO|FILTERS|TRAITS]
-					auto size = conditions.size();
-
-					if (size > 1) {
-						auto filters = split_sub_string(conditions[1]);
-						for (auto& filter : filters) {
-							if (filter.contains("+"sv)) {
-								auto filters_ALL = string::split(filter, "+");
-								for (auto& filter_ALL : filters_ALL) {
-									push_filter(filter_ALL, conditionalSwap.conditions.ALL);
-								}
-							} else {
-								auto id = filter.at(0);
-								if (id == '-') {
-									filter.erase(0, 1);
-									push_filter(filter, conditionalSwap.conditions.NOT);
-								} else if (id == '*') {
-									filter.erase(0, 1);
-									conditionalSwap.conditions.ANY.push_back(filter);  // string
-								} else {
-									push_filter(filter, conditionalSwap.conditions.MATCH);
-								}
-							}
-						}
-					}
-
-					if (size > 2) {
-						const auto& traits = split_sub_string(conditions[2]);
-						for (auto& trait : traits) {
-							if (trait == "M" || trait == "-F") {
-								conditionalSwap.conditions.traits.sex = RE::SEX::kMale;
-							} else if (trait == "F" || trait == "-M") {
-								conditionalSwap.conditions.traits.sex = RE::SEX::kFemale;
-							} else if (trait == "C") {
-								conditionalSwap.conditions.traits.child = true;
-							} else if (trait == "-C") {
-								conditionalSwap.conditions.traits.child = false;
-							}
-						}
-					}
-				}
-
 				if (const auto values = ini.GetSection(section); values && !values->empty()) {
+					// everything syntactic is parsed here, only form resolution is deferred
+					auto& sectionData = _sections.emplace_back(std::make_unique<Section>());
+					sectionData->path = path;
+					sectionData->name = section;
+					sectionData->conditions = ParseConditions(section);
+
 					for (const auto& key : *values | std::views::keys) {
 						auto splitValue = string::split(key.pItem, "|");
 
 						if (RE::FormID baseAnio = GetFormID(splitValue[0]); baseAnio != 0) {
-							FormIDSet tempSwapAnimObjects{};
-
-							auto swapAnioEntry = string::split(splitValue[1], ",");
-							for (auto& swapAnioStr : swapAnioEntry) {
-								if (RE::FormID swapAnio = GetFormID(swapAnioStr); swapAnio != 0) {
-									if (noConditions) {
-										_animObjects[baseAnio].insert(swapAnio);
-									} else {
-										tempSwapAnimObjects.insert(swapAnio);
+							RawSwap rawSwap{ sectionData.get() };
+							if (splitValue.size() > 1) {
+								for (auto& swapAnioStr : string::split(splitValue[1], ",")) {
+									if (!IsValidFormID(swapAnioStr)) {
+										logger::error("			Swap ANIO [{}] FAIL (malformed formID/editorID)", swapAnioStr);
+										continue;
 									}
-								} else {
-									logger::error("			Swap ANIO [{}] FAIL (invalid formID/editorID)", swapAnioStr);
+									rawSwap.swapAnimObjects.push_back(swapAnioStr);
 								}
 							}
 
-							if (!noConditions) {
-								conditionalSwap.swappedAnimObjects = tempSwapAnimObjects;
-								_animObjectsConditional[baseAnio].push_back(conditionalSwap);
+							auto& animObjectSwaps = _animObjects[baseAnio];
+							if (!animObjectSwaps) {
+								animObjectSwaps = std::make_unique<AnimObjectSwaps>();
 							}
+							animObjectSwaps->rawSwaps.push_back(std::move(rawSwap));
 						} else {
 							logger::error("			Base ANIO [{}] FAIL (invalid formID/editorID)", splitValue[0]);
 						}
@@ -207,40 +201,395 @@ namespace AnimObjectSwap
 
 		logger::info("{:*^30}", "RESULT");
 
-		logger::info("{} animobject swaps found", _animObjects.size());
-		for (auto& animObject : _animObjects) {
-			logger::info("	{} : {} variations", RE::TESForm::LookupByID(animObject.first)->GetFormEditorID(), animObject.second.size());
+		logger::info("{} animobjects with swaps found", _animObjects.size());
+		for (auto& [animObject, animObjectSwaps] : _animObjects) {
+			logger::info("	{} : {} swap entries", RE::TESForm::LookupByID(animObject)->GetFormEditorID(), animObjectSwaps->rawSwaps.size());
+		}
+
+		if (_warmUpCount > 0 && !_animObjects.empty()) {
+			// anim objects with the most swap entries stand in for the most commonly used ones
+			std::vector<AnimObjectSwaps*> warmUpOrder;
+			warmUpOrder.reserve(_animObjects.size());
+			for (const auto& animObjectSwaps : _animObjects | std::views::values) {
+				warmUpOrder.push_back(animObjectSwaps.get());
+			}
+			std::ranges::sort(warmUpOrder, std::greater{}, [](const auto* a_swaps) { return a_swaps->rawSwaps.size(); });
+			if (warmUpOrder.size() > _warmUpCount) {
+				warmUpOrder.resize(_warmUpCount);
+			}
+
+			logger::info("Warming up {} animobjects", warmUpOrder.size());
+
+			// Same resolution the hook does lazily from whichever thread loads anim objects. It only reads:
+			// TESForm lookups take the engine's form map read locks, the data handler's file list and
+			// MergeMapper's tables are fixed before kDataLoaded, and WorldState registration is locked.
+			std::thread([this, warmUpOrder = std::move(warmUpOrder)]() {
+				try {
+					for (const auto& animObjectSwaps : warmUpOrder) {
+						CompileSwaps(*animObjectSwaps);
+					}
+				} catch (const std::exception& e) {
+					logger::error("Warm up failed : {}", e.what());
+				}
+			}).detach();
+		}
+
+		return !_animObjects.empty();
+	}
+
+	void Manager::SelfCheck()
+	{
+		if (!_selfCheck) {
+			return;
 		}
 
-		logger::info("{} conditional animobject swaps found", _animObjectsConditional.size());
-		for (auto& animObject : _animObjectsConditional) {
-			logger::info("	{} : {} conditional variations", RE::TESForm::LookupByID(animObject.first)->GetFormEditorID(), animObject.second.size());
+		const auto player = RE::PlayerCharacter::GetSingleton();
+		if (!player) {
+			return;
 		}
 
-		return !_animObjects.empty() || !_animObjectsConditional.empty();
+		logger::info("{:*^30}", "SELF CHECK");
+
+		// evaluate every conditional section with both evaluators against the player
+		std::size_t checked = 0;
+		std::size_t mismatches = 0;
+		for (const auto& section : _sections) {
+			if (!section->conditions) {
+				continue;
+			}
+
+			const auto conditions = ResolveFilters(*section, false);
+			const auto interpreted = Filter::PassFilter(player, conditions);
+			const auto compiled = Filter::PassFilter(player, Filter::Compile(conditions));
+			if (interpreted != compiled) {
+				logger::error("	{} [{}] MISMATCH : interpreted {}, compiled {}", section->path, section->name, interpreted, compiled);
+				++mismatches;
+			}
+			++checked;
+		}
+
+		logger::info("{} conditional sections checked, {} mismatches", checked, mismatches);
 	}
 
-	RE::TESObjectANIO* Manager::GetSwappedAnimObject(RE::TESObjectREFR* a_user, RE::TESObjectANIO* a_animObject)
+	std::optional<Manager::ParsedConditions> Manager::ParseConditions(const std::string& a_section)
 	{
-		const auto origFormID = a_animObject->GetFormID();
-
-		if (const auto it = _animObjectsConditional.find(origFormID); it != _animObjectsConditional.end()) {
-			if (const auto actor = a_user ? a_user->As<RE::Actor>() : nullptr; actor) {
-				if (const auto result = std::ranges::find_if(it->second, [&](const auto& conditionalSwap) {
-						return Filter::PassFilter(actor, conditionalSwap.conditions);
-					});
-					result != it->second.end()) {
-					return GetSwappedAnimObject(result->swappedAnimObjects);
+		if (!string::icontains(a_section, "|")) {
+			return std::nullopt;
+		}
+
+		constexpr auto split_sub_string = [](const std::string& a_str, const std::string& a_delimiter = ",") {
+			if (!a_str.empty() && !string::icontains(a_str, "NONE"sv)) {
+				return string::split(a_str, a_delimiter);
+			}
+			return std::vector<std::string>();
+		};
+
+		constexpr auto push_filter = [](const std::string& a_filter, std::vector<std::string>& a_filters) {
+			if (a_filter.empty()) {
+				logger::error("		Filter  [] INFO - empty entry, skipping");
+				return;
+			}
+			if (a_filter.contains("~"sv) && !IsValidFormID(a_filter)) {
+				logger::error("		Filter  [{}] INFO - malformed formID, treating filter as string", a_filter);
+			}
+			a_filters.push_back(a_filter);
+		};
+
+		ParsedConditions parsedConditions{};
+
+		auto conditions = string::split(a_section, "|");  // [ANIO|FILTERS|TRAITS|WORLD]
+		auto size = conditions.size();
+
+		if (size > 4) {
+			logger::error("		Section [{}] INFO - too many fields, ignoring extra", a_section);
+		}
+
+		if (size > 1) {
+			auto filters = split_sub_string(conditions[1]);
+			for (auto& filter : filters) {
+				if (filter.contains("+"sv)) {
+					auto filters_ALL = string::split(filter, "+");
+					for (auto& filter_ALL : filters_ALL) {
+						push_filter(filter_ALL, parsedConditions.ALL);
+					}
+				} else if (filter.starts_with('-')) {
+					push_filter(filter.substr(1), parsedConditions.NOT);
+				} else if (filter.starts_with('*')) {
+					if (filter.size() > 1) {
+						parsedConditions.ANY.push_back(filter.substr(1));  // string
+					} else {
+						logger::error("		Filter  [*] INFO - empty entry, skipping");
+					}
+				} else {
+					push_filter(filter, parsedConditions.MATCH);
+				}
+			}
+		}
+
+		if (size > 2) {
+			const auto& traits = split_sub_string(conditions[2]);
+			for (auto& trait : traits) {
+				if (trait == "M" || trait == "-F") {
+					parsedConditions.traits.sex = RE::SEX::kMale;
+				} else if (trait == "F" || trait == "-M") {
+					parsedConditions.traits.sex = RE::SEX::kFemale;
+				} else if (trait == "C") {
+					parsedConditions.traits.child = true;
+				} else if (trait == "-C") {
+					parsedConditions.traits.child = false;
 				}
 			}
 		}
 
-		if (const auto it = _animObjects.find(origFormID); it != _animObjects.end()) {
-			if (const auto& swapANIO = it->second; !swapANIO.empty()) {
-				return GetSwappedAnimObject(swapANIO);
+		if (size > 3) {
+			const auto& worldFilters = split_sub_string(conditions[3]);
+			for (auto& worldFilter : worldFilters) {
+				if (WorldFilter parsedWorldFilter{}; ParseWorldFilter(worldFilter, parsedWorldFilter)) {
+					parsedConditions.world.push_back(std::move(parsedWorldFilter));
+				} else {
+					// any bad entry disables the rule instead of dropping the gate
+					logger::error("		World filter [{}] INFO - invalid range, rule disabled", worldFilter);
+					parsedConditions.invalidWorld = true;
+				}
 			}
 		}
 
+		return parsedConditions;
+	}
+
+	bool Manager::ParseWorldFilter(const std::string& a_filter, WorldFilter& a_worldFilter)
+	{
+		constexpr auto parse_float = [](std::string_view a_str) -> std::optional<float> {
+			float value = 0.0f;
+			const auto [ptr, ec] = std::from_chars(a_str.data(), a_str.data() + a_str.size(), value);
+			if (ec != std::errc() || ptr != a_str.data() + a_str.size()) {
+				return std::nullopt;
+			}
+			return value;
+		};
+
+		if (a_filter.empty()) {
+			return false;
+		}
+
+		// NAME(MIN-MAX) or NAME(VALUE)
+		const auto pos = a_filter.find('(');
+		if (pos == std::string::npos) {
+			a_worldFilter.name = a_filter;
+			return true;
+		}
+		if (!a_filter.ends_with(')')) {
+			return false;
+		}
+
+		a_worldFilter.name = a_filter.substr(0, pos);
+		const auto rangeStr = std::string_view(a_filter).substr(pos + 1, a_filter.size() - pos - 2);
+		if (const auto dash = rangeStr.find('-', 1); dash != std::string_view::npos) {
+			const auto min = parse_float(rangeStr.substr(0, dash));
+			const auto max = parse_float(rangeStr.substr(dash + 1));
+			if (min && max) {
+				a_worldFilter.range = Range{ *min, *max };
+			}
+		} else if (const auto value = parse_float(rangeStr); value) {
+			a_worldFilter.range = Range{ *value, *value };
+		}
+
+		return a_worldFilter.range.has_value();
+	}
+
+	Conditions Manager::ResolveFilters(const Section& a_section, bool a_log)
+	{
+		const auto& parsedConditions = *a_section.conditions;
+
+		const auto push_filters = [&](const std::vector<std::string>& a_filters, FormIDStrVec& a_processedFilters) {
+			for (const auto& filter : a_filters) {
+				if (const auto processedID = GetFormID(filter); processedID != 0) {
+					a_processedFilters.push_back(processedID);
+				} else {
+					if (a_log) {
+						logger::error("		Filter  [{}] INFO - unable to find form, treating filter as string ({} : [{}])", filter, a_section.path, a_section.name);
+					}
+					a_processedFilters.push_back(filter);
+				}
+			}
+		};
+
+		Conditions conditions{};
+		push_filters(parsedConditions.ALL, conditions.ALL);
+		push_filters(parsedConditions.NOT, conditions.NOT);
+		push_filters(parsedConditions.MATCH, conditions.MATCH);
+		conditions.ANY.assign(parsedConditions.ANY.begin(), parsedConditions.ANY.end());
+		conditions.traits = parsedConditions.traits;
+
+		return conditions;
+	}
+
+	std::optional<std::uint32_t> Manager::ResolveWorld(const Section& a_section)
+	{
+		const auto& parsedConditions = *a_section.conditions;
+		if (parsedConditions.world.empty() && !parsedConditions.invalidWorld) {
+			return std::nullopt;
+		}
+
+		WorldConditions worldConditions{};
+		worldConditions.invalid = parsedConditions.invalidWorld;
+
+		// any bad entry disables the rule instead of dropping the gate
+		const auto disable = [&](const WorldFilter& a_worldFilter, std::string_view a_reason) {
+			logger::error("		World filter [{}] INFO - {}, rule disabled ({} : [{}])", a_worldFilter.name, a_reason, a_section.path, a_section.name);
+			worldConditions.invalid = true;
+		};
+
+		for (const auto& worldFilter : parsedConditions.world) {
+			const auto& [name, range] = worldFilter;
+
+			if (name == "H" || name == "h") {
+				if (range) {
+					worldConditions.hours = range;
+				} else {
+					disable(worldFilter, "missing hour range"sv);
+				}
+				continue;
+			}
+
+			const auto form = RE::TESForm::LookupByID(GetFormID(name));
+			if (!form) {
+				disable(worldFilter, "unable to find form"sv);
+				continue;
+			}
+
+			switch (form->GetFormType()) {
+			case RE::FormType::Weather:
+			case RE::FormType::Climate:
+				{
+					if (range) {
+						disable(worldFilter, "unexpected range"sv);
+						break;
+					}
+					auto& forms = form->Is(RE::FormType::Weather) ? worldConditions.weathers : worldConditions.climates;
+					forms.insert(form->GetFormID());
+				}
+				break;
+			case RE::FormType::Global:
+			case RE::FormType::Quest:
+				{
+					if (!range) {
+						disable(worldFilter, "missing value range"sv);
+						break;
+					}
+					auto& ranges = form->Is(RE::FormType::Global) ? worldConditions.globals : worldConditions.questStages;
+					ranges.emplace_back(form->GetFormID(), *range);
+				}
+				break;
+			default:
+				disable(worldFilter, "unsupported form type"sv);
+				break;
+			}
+		}
+
+		return WorldState::GetSingleton()->Register(std::move(worldConditions));
+	}
+
+	template <class T>
+	const std::optional<ConditionalSwap<T>>& Manager::ResolveSection(Section& a_section)
+	{
+		std::call_once(a_section.resolved, [&]() {
+			if (!a_section.conditions) {
+				return;
+			}
+
+			ConditionalSwap<Conditions> conditionalSwap{ ResolveWorld(a_section), ResolveFilters(a_section, true) };
+			if constexpr (std::is_same_v<T, CompiledConditions>) {
+				a_section.compiled = ConditionalSwap<CompiledConditions>{ conditionalSwap.worldConditions, Filter::Compile(conditionalSwap.conditions) };
+			} else {
+				a_section.interpreted = std::move(conditionalSwap);
+			}
+		});
+
+		if constexpr (std::is_same_v<T, CompiledConditions>) {
+			return a_section.compiled;
+		} else {
+			return a_section.interpreted;
+		}
+	}
+
+	template <class T>
+	void Manager::BuildSwaps(AnimObjectSwaps& a_animObjectSwaps)
+	{
+		auto& conditionalSwaps = a_animObjectSwaps.conditionalSwaps.emplace<ConditionalSwaps<T>>();
+
+		for (const auto& [section, swapAnimObjects] : a_animObjectSwaps.rawSwaps) {
+			// sections are shared between keys and resolved once
+			const auto& conditionalSwap = ResolveSection<T>(*section);
+			auto& swappedAnimObjects = conditionalSwap ? conditionalSwaps.emplace_back(*conditionalSwap).swappedAnimObjects : a_animObjectSwaps.swaps;
+
+			for (const auto& swapAnioStr : swapAnimObjects) {
+				if (RE::FormID swapAnio = GetFormID(swapAnioStr); swapAnio != 0) {
+					swappedAnimObjects.insert(swapAnio);
+				} else {
+					logger::error("			Swap ANIO [{}] FAIL (invalid formID/editorID) ({} : [{}])", swapAnioStr, section->path, section->name);
+				}
+			}
+		}
+	}
+
+	void Manager::CompileSwaps(AnimObjectSwaps& a_animObjectSwaps)
+	{
+		std::call_once(a_animObjectSwaps.compiled, [&]() {
+			try {
+				if (_compileFilters) {
+					BuildSwaps<CompiledConditions>(a_animObjectSwaps);
+				} else {
+					BuildSwaps<Conditions>(a_animObjectSwaps);
+				}
+			} catch (const std::exception& e) {
+				// leave this anim object unswapped rather than unwinding into the engine
+				logger::error("Failed to build animobject swaps : {}", e.what());
+				a_animObjectSwaps.swaps.clear();
+				a_animObjectSwaps.conditionalSwaps.emplace<ConditionalSwaps<Conditions>>();
+			}
+
+			a_animObjectSwaps.rawSwaps = {};
+		});
+	}
+
+	RE::TESObjectANIO* Manager::GetSwappedAnimObject(RE::TESObjectREFR* a_user, RE::TESObjectANIO* a_animObject)
+	{
+		const auto it = _animObjects.find(a_animObject->GetFormID());
+		if (it == _animObjects.end()) {
+			return a_animObject;
+		}
+
+		auto& animObjectSwaps = *it->second;
+		CompileSwaps(animObjectSwaps);
+
+		if (const auto actor = a_user ? a_user->As<RE::Actor>() : nullptr; actor) {
+			const auto result = std::visit([&](const auto& a_conditionalSwaps) -> const FormIDSet* {
+				// only fetched once a rule with world preconditions is reached
+				std::shared_ptr<const WorldState::Snapshot> worldState{};
+				const auto match = std::ranges::find_if(a_conditionalSwaps, [&](const auto& conditionalSwap) {
+					if (conditionalSwap.worldConditions) {
+						if (!worldState) {
+							worldState = WorldState::GetSingleton()->GetSnapshot();
+						}
+						if (!worldState->Pass(*conditionalSwap.worldConditions)) {
+							return false;
+						}
+					}
+					return Filter::PassFilter(actor, conditionalSwap.conditions);
+				});
+				return match != a_conditionalSwaps.end() ? std::addressof(match->swappedAnimObjects) : nullptr;
+			}, animObjectSwaps.conditionalSwaps);
+
+			if (result) {
+				return GetSwappedAnimObject(*result);
+			}
+		}
+
+		if (const auto& swapANIO = animObjectSwaps.swaps; !swapANIO.empty()) {
+			return GetSwappedAnimObject(swapANIO);
+		}
+
 		return a_animObject;
 	}
 
@@ -5,7 +5,6 @@ namespace AnimObjectSwap
 	template <class K, class D>
 	using Map = robin_hood::unordered_flat_map<K, D>;
 	using FormIDSet = robin_hood::unordered_flat_set<RE::FormID>;
-	using FormIDMap = Map<RE::FormID, FormIDSet>;
 
 	using FormIDStr = std::variant<RE::FormID, std::string>;
 	using FormIDStrVec = std::vector<FormIDStr>;
@@ -16,6 +15,22 @@ namespace AnimObjectSwap
 		std::optional<bool> child{ std::nullopt };
 	};
 
+	using Range = std::pair<float, float>;
+
+	// world state preconditions, registered with WorldState and evaluated once per frame for all rules
+	struct WorldConditions
+	{
+		[[nodiscard]] bool empty() const { return !invalid && !hours && weathers.empty() && climates.empty() && globals.empty() && questStages.empty(); }
+
+		bool invalid{ false };  // a malformed or unresolved entry, the rule never passes
+
+		std::optional<Range> hours{ std::nullopt };
+		FormIDSet weathers{};
+		FormIDSet climates{};
+		std::vector<std::pair<RE::FormID, Range>> globals{};
+		std::vector<std::pair<RE::FormID, Range>> questStages{};
+	};
+
 	struct Conditions
 	{
 		FormIDStrVec ALL{};
@@ -26,12 +41,48 @@ namespace AnimObjectSwap
 		Traits traits{};
 	};
 
+	// filters resolved at load: NPC/race FormID compares, direct form matchers and string matchers
+	struct CompiledFilter
+	{
+		[[nodiscard]] bool empty() const { return npcs.empty() && races.empty() && forms.empty() && strings.empty() && !unresolved; }
+
+		FormIDSet npcs{};
+		FormIDSet races{};
+		std::vector<RE::TESForm*> forms{};
+		std::vector<std::string> strings{};
+		bool unresolved{ false };  // a FormID that failed to resolve never matches
+	};
+
+	struct CompiledConditions
+	{
+		enum Trait : std::uint8_t
+		{
+			kNone = 0,
+			kMale = 1 << 0,
+			kFemale = 1 << 1,
+			kChild = 1 << 2,
+			kAdult = 1 << 3
+		};
+
+		std::uint8_t traits{ kNone };  // required trait bits
+		CompiledFilter ALL{};
+		CompiledFilter NOT{};
+		CompiledFilter MATCH{};
+		std::vector<std::string> ANY{};
+	};
+
+	// T is either Conditions (interpreted) or CompiledConditions, chosen once per base ANIO
+	template <class T>
 	struct ConditionalSwap
 	{
-		Conditions conditions{};
+		std::optional<std::uint32_t> worldConditions{ std::nullopt };  // WorldState index
+		T conditions{};
 		FormIDSet swappedAnimObjects{};
 	};
 
+	template <class T>
+	using ConditionalSwaps = std::vector<ConditionalSwap<T>>;
+
 	class Manager
 	{
 	public:
@@ -43,7 +94,9 @@ namespace AnimObjectSwap
 
 		static std::string GetEditorID(const RE::TESForm* a_form);
 
+		void LoadSettings();
 		bool LoadForms();
+		void SelfCheck();
 		RE::TESObjectANIO* GetSwappedAnimObject(RE::TESObjectREFR* a_user, RE::TESObjectANIO* a_animObject);
 
 	protected:
@@ -58,11 +111,76 @@ namespace AnimObjectSwap
 	private:
 		using _GetFormEditorID = const char* (*)(std::uint32_t);
 
+		struct WorldFilter
+		{
+			std::string name{};
+			std::optional<Range> range{ std::nullopt };
+		};
+
+		// [ANIO|FILTERS|TRAITS|WORLD] split into tokens at load, forms are resolved on first use
+		struct ParsedConditions
+		{
+			std::vector<std::string> ALL{};
+			std::vector<std::string> NOT{};
+			std::vector<std::string> MATCH{};
+			std::vector<std::string> ANY{};
+
+			Traits traits{};
+
+			std::vector<WorldFilter> world{};
+			bool invalidWorld{ false };
+		};
+
+		// INI section shared by every key in it, resolved once by whichever base ANIO needs it first
+		struct Section
+		{
+			std::string path{};
+			std::string name{};
+			std::optional<ParsedConditions> conditions{ std::nullopt };  // nullopt for unconditional sections
+
+			std::once_flag resolved{};
+			std::optional<ConditionalSwap<Conditions>> interpreted{ std::nullopt };
+			std::optional<ConditionalSwap<CompiledConditions>> compiled{ std::nullopt };
+		};
+
+		// swap entries indexed by base ANIO at load, resolved on first use
+		struct RawSwap
+		{
+			Section* section{ nullptr };
+			std::vector<std::string> swapAnimObjects{};
+		};
+
+		struct AnimObjectSwaps
+		{
+			std::vector<RawSwap> rawSwaps{};
+			std::once_flag compiled{};
+
+			FormIDSet swaps{};
+			std::variant<ConditionalSwaps<Conditions>, ConditionalSwaps<CompiledConditions>> conditionalSwaps{};
+		};
+
 		static RE::FormID GetFormID(const std::string& a_str);
+		static bool IsValidFormID(const std::string& a_str);
+
+		static std::optional<ParsedConditions> ParseConditions(const std::string& a_section);
+		static bool ParseWorldFilter(const std::string& a_filter, WorldFilter& a_worldFilter);
+
+		static Conditions ResolveFilters(const Section& a_section, bool a_log);
+		static std::optional<std::uint32_t> ResolveWorld(const Section& a_section);
+		template <class T>
+		static const std::optional<ConditionalSwap<T>>& ResolveSection(Section& a_section);
+
+		void CompileSwaps(AnimObjectSwaps& a_animObjectSwaps);
+		template <class T>
+		void BuildSwaps(AnimObjectSwaps& a_animObjectSwaps);
 
 		[[nodiscard]] RE::TESObjectANIO* GetSwappedAnimObject(const FormIDSet& a_animObject) const;
 
-		FormIDMap _animObjects;
-		Map<RE::FormID, std::vector<ConditionalSwap>> _animObjectsConditional;
+		bool _compileFilters{ false };
+		bool _selfCheck{ false };
+		std::uint32_t _warmUpCount{ 0 };
+
+		std::vector<std::unique_ptr<Section>> _sections;
+		Map<RE::FormID, std::unique_ptr<AnimObjectSwaps>> _animObjects;
 	};
 }
@@ -0,0 +1,84 @@
+#include "WorldState.h"
+#include "LookupFilters.h"
+
+namespace AnimObjectSwap
+{
+	std::uint32_t WorldState::Register(WorldConditions a_conditions)
+	{
+		std::scoped_lock locker(_lock);
+
+		for (const auto& formID : a_conditions.globals | std::views::keys) {
+			_trackedGlobals.insert(formID);
+		}
+		for (const auto& formID : a_conditions.questStages | std::views::keys) {
+			_trackedQuests.insert(formID);
+		}
+
+		const auto index = static_cast<std::uint32_t>(_conditions.size());
+		_conditions.push_back(std::move(a_conditions));
+
+		// snapshots older than this have no result for the new index and get rebuilt on the next read
+		_registered.store(_conditions.size(), std::memory_order_release);
+
+		return index;
+	}
+
+	std::shared_ptr<const WorldState::Snapshot> WorldState::GetSnapshot()
+	{
+		// application run time (ms) is advanced by the engine once per frame, paused or not
+		const auto frame = RE::GetDurationOfApplicationRunTime();
+
+		const auto is_current = [&](const std::shared_ptr<const Snapshot>& a_snapshot) {
+			return a_snapshot && a_snapshot->frame == frame && a_snapshot->results.size() >= _registered.load(std::memory_order_acquire);
+		};
+
+		if (auto snapshot = _snapshot.load(std::memory_order_acquire); is_current(snapshot)) {
+			return snapshot;
+		}
+
+		std::scoped_lock locker(_lock);
+
+		auto snapshot = _snapshot.load(std::memory_order_acquire);
+		if (!is_current(snapshot)) {
+			snapshot = TakeSnapshot(frame);
+			_snapshot.store(snapshot, std::memory_order_release);
+		}
+
+		return snapshot;
+	}
+
+	std::shared_ptr<const WorldState::Snapshot> WorldState::TakeSnapshot(std::uint32_t a_frame) const
+	{
+		auto snapshot = std::make_shared<Snapshot>();
+		snapshot->frame = a_frame;
+
+		if (const auto calendar = RE::Calendar::GetSingleton(); calendar) {
+			snapshot->gameHour = calendar->GetHour();
+		}
+
+		if (const auto sky = RE::Sky::GetSingleton(); sky) {
+			snapshot->weather = sky->currentWeather ? sky->currentWeather->GetFormID() : 0;
+			snapshot->climate = sky->currentClimate ? sky->currentClimate->GetFormID() : 0;
+		}
+
+		for (const auto& formID : _trackedGlobals) {
+			if (const auto global = RE::TESForm::LookupByID<RE::TESGlobal>(formID); global) {
+				snapshot->globals.emplace(formID, global->value);
+			}
+		}
+
+		for (const auto& formID : _trackedQuests) {
+			if (const auto quest = RE::TESForm::LookupByID<RE::TESQuest>(formID); quest) {
+				snapshot->questStages.emplace(formID, static_cast<float>(quest->GetCurrentStageID()));
+			}
+		}
+
+		// every registered precondition is evaluated once here, rules only read the result
+		snapshot->results.reserve(_conditions.size());
+		for (const auto& conditions : _conditions) {
+			snapshot->results.push_back(Filter::PassFilter(*snapshot, conditions));
+		}
+
+		return snapshot;
+	}
+}
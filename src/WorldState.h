@@ -0,0 +1,53 @@
+#pragma once
+
+#include "Manager.h"
+
+namespace AnimObjectSwap
+{
+	class WorldState
+	{
+	public:
+		struct Snapshot
+		{
+			[[nodiscard]] bool Pass(std::uint32_t a_index) const { return results[a_index]; }
+
+			std::uint32_t frame{ 0 };
+			float gameHour{ 0.0f };
+			RE::FormID weather{ 0 };
+			RE::FormID climate{ 0 };
+			Map<RE::FormID, float> globals{};
+			Map<RE::FormID, float> questStages{};
+
+			std::vector<bool> results{};  // one per registered WorldConditions
+		};
+
+		[[nodiscard]] static WorldState* GetSingleton()
+		{
+			static WorldState singleton;
+			return std::addressof(singleton);
+		}
+
+		std::uint32_t Register(WorldConditions a_conditions);
+		std::shared_ptr<const Snapshot> GetSnapshot();
+
+	protected:
+		WorldState() = default;
+		WorldState(const WorldState&) = delete;
+		WorldState(WorldState&&) = delete;
+		~WorldState() = default;
+
+		WorldState& operator=(const WorldState&) = delete;
+		WorldState& operator=(WorldState&&) = delete;
+
+	private:
+		[[nodiscard]] std::shared_ptr<const Snapshot> TakeSnapshot(std::uint32_t a_frame) const;
+
+		std::mutex _lock;
+		std::vector<WorldConditions> _conditions;
+		FormIDSet _trackedGlobals;
+		FormIDSet _trackedQuests;
+
+		std::atomic<std::size_t> _registered{ 0 };
+		std::atomic<std::shared_ptr<const Snapshot>> _snapshot{};
+	};
+}
@@ -26,9 +26,15 @@ void MessageHandler(SKSE::MessagingInterface::Message* a_message)
 	case SKSE::MessagingInterface::kDataLoaded:
 		{
 			logger::info("{:*^30}", "INI");
-			AnimObjectSwap::Manager::GetSingleton()->LoadForms();
+			const auto manager = AnimObjectSwap::Manager::GetSingleton();
+			manager->LoadSettings();
+			manager->LoadForms();
 		}
 		break;
+	case SKSE::MessagingInterface::kPostLoadGame:
+	case SKSE::MessagingInterface::kNewGame:
+		AnimObjectSwap::Manager::GetSingleton()->SelfCheck();
+		break;
 	default:
 		break;
 	}